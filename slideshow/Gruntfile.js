@@ -83,7 +83,8 @@ module.exports = function(grunt) {
 					console: false,
 					unescape: false,
 					define: false,
-					exports: false
+					exports: false,
+					require: false
 				}
 			},
 			files: [ 'Gruntfile.js', 'js/reveal.js' ]
@@ -100,6 +101,40 @@ module.exports = function(grunt) {
 			}
 		},
 
+		markdown: {
+			presentation: {
+				src: 'index.html',
+				dest: 'index.compiled.html'
+			}
+		},
+
+		searchindex: {
+			presentation: {
+				src: 'index.html',
+				dest: 'search-index.json'
+			}
+		},
+
+		incremental: {
+			options: {
+				cache: '.grunt-cache.json'
+			},
+			themes: {
+				task: 'sass:themes'
+			},
+			core: {
+				src: [ 'css/reveal.scss' ],
+				dest: [ 'css/reveal.css', 'css/reveal.min.css' ],
+				tasks: [ 'sass:core', 'autoprefixer', 'cssmin' ]
+			},
+			js: {
+				// Includes the scripts loaded by the qunit pages
+				src: [ 'Gruntfile.js', 'js/reveal.js', 'test/**', 'lib/js/head.min.js', 'plugin/markdown/*.js', 'plugin/search/indexer.js' ],
+				dest: [ 'js/reveal.min.js' ],
+				tasks: [ 'jshint', 'uglify', 'qunit' ]
+			}
+		},
+
 		zip: {
 			'reveal-js-presentation.zip': [
 				'index.html',
@@ -108,7 +143,8 @@ module.exports = function(grunt) {
 				'lib/**',
 				'images/**',
 				'plugin/**',
-				'**.md'
+				'**.md',
+				'search-index.json'
 			]
 		},
 
@@ -122,7 +158,7 @@ module.exports = function(grunt) {
 			},
 			theme: {
 				files: [ 'css/theme/source/*.scss', 'css/theme/template/*.scss' ],
-				tasks: 'css-themes'
+				tasks: 'incremental:themes'
 			},
 			css: {
 				files: [ 'css/reveal.scss' ],
@@ -149,6 +185,132 @@ module.exports = function(grunt) {
 	grunt.loadNpmTasks( 'grunt-autoprefixer' );
 	grunt.loadNpmTasks( 'grunt-zip' );
 
+	// Ahead of time compilation of markdown slides
+	grunt.registerMultiTask( 'markdown', 'Compile markdown slides to HTML', function() {
+		var path = require( 'path' ),
+			RevealMarkdown = require( './plugin/markdown/markdown.js' ),
+			src = this.data.src;
+
+		grunt.file.write( this.data.dest, RevealMarkdown.compile( grunt.file.read( src ), {
+			readFile: function( url, charset ) {
+				return grunt.file.read( path.join( path.dirname( src ), url ), { encoding: charset || 'utf8' } );
+			},
+			warn: function( message ) {
+				grunt.log.warn( src + ': ' + message );
+			}
+		} ) );
+		grunt.log.writeln( 'File ' + this.data.dest + ' created.' );
+	} );
+
+	// Inverted index of the slides text for the search plugin
+	grunt.registerMultiTask( 'searchindex', 'Build the search plugin index', function() {
+		var buildIndex = require( './plugin/search/indexer.js' );
+
+		try {
+			grunt.file.write( this.data.dest, JSON.stringify( buildIndex( grunt.file.read( this.data.src ) ) ) );
+			grunt.log.writeln( 'File ' + this.data.dest + ' created.' );
+		}
+		catch( e ) {
+			grunt.fail.warn( this.data.src + ': ' + e.message );
+		}
+	} );
+
+	// Content hashes of the sources each output was last built from,
+	// saved by incremental-save once the queued tasks have succeeded
+	var pendingHashes = {};
+
+	// Hashes a list of files along with the Sass partials they import
+	function hashSources( files ) {
+		var crypto = require( 'crypto' ),
+			path = require( 'path' ),
+			hash = crypto.createHash( 'sha1' ),
+			seen = {};
+
+		function add( file ) {
+			if( seen[ file ] || !grunt.file.isFile( file ) ) return;
+			seen[ file ] = true;
+
+			var content = grunt.file.read( file ),
+				pattern = /@import\s+(['"])([^'"]+)\1/g,
+				match;
+
+			hash.update( file + '\0' + content + '\0' );
+
+			if( path.extname( file ) === '.scss' ) {
+				while( ( match = pattern.exec( content ) ) ) {
+					var name = path.join( path.dirname( file ), match[2] );
+					add( name + '.scss' );
+					add( path.join( path.dirname( name ), '_' + path.basename( name ) + '.scss' ) );
+					add( name );
+				}
+			}
+		}
+
+		files.forEach( add );
+
+		return hash.digest( 'hex' );
+	}
+
+	// Only rebuilds the outputs whose sources, or the Sass partials
+	// they import, changed since the last successful build
+	grunt.registerMultiTask( 'incremental', 'Rebuild outputs with changed sources', function() {
+		var cacheFile = this.options().cache,
+			cache = grunt.file.exists( cacheFile ) ? grunt.file.readJSON( cacheFile ) : {};
+
+		function isStale( key, dest, hash ) {
+			return cache[ key ] !== hash || !dest.every( function( file ) {
+				return grunt.file.exists( file );
+			} );
+		}
+
+		if( this.data.task ) {
+			// Per file targets, such as one theme, narrowed down to the
+			// stale files. grunt-sass renders these concurrently
+			var taskConfig = this.data.task.replace( ':', '.' ),
+				files = grunt.task.normalizeMultiTaskFiles( grunt.config( taskConfig ) ),
+				stale = files.filter( function( file ) {
+					var hash = hashSources( file.src );
+
+					if( isStale( file.dest, [ file.dest ], hash ) ) {
+						pendingHashes[ file.dest ] = hash;
+						return true;
+					}
+				} );
+
+			if( stale.length ) {
+				grunt.config( taskConfig + '.files', stale.map( function( file ) {
+					return { src: file.src, dest: file.dest };
+				} ) );
+				grunt.task.run( this.data.task, 'incremental-save:' + cacheFile );
+			}
+
+			grunt.log.writeln( stale.length + ' of ' + files.length + ' files to rebuild.' );
+		}
+		else {
+			// Bundles built from all their sources at once
+			var hash = hashSources( grunt.file.expand( { filter: 'isFile' }, this.data.src ) );
+
+			if( isStale( this.target, this.data.dest, hash ) ) {
+				pendingHashes[ this.target ] = hash;
+				grunt.task.run( this.data.tasks.concat( 'incremental-save:' + cacheFile ) );
+			}
+			else {
+				grunt.log.writeln( 'Up to date.' );
+			}
+		}
+	} );
+
+	grunt.registerTask( 'incremental-save', function( cacheFile ) {
+		var cache = grunt.file.exists( cacheFile ) ? grunt.file.readJSON( cacheFile ) : {};
+
+		Object.keys( pendingHashes ).forEach( function( key ) {
+			cache[ key ] = pendingHashes[ key ];
+		} );
+
+		pendingHashes = {};
+		grunt.file.write( cacheFile, JSON.stringify( cache, null, '\t' ) );
+	} );
+
 	// Default task
 	grunt.registerTask( 'default', [ 'css', 'js' ] );
 
@@ -164,8 +326,11 @@ module.exports = function(grunt) {
 	// All CSS
 	grunt.registerTask( 'css', [ 'sass', 'autoprefixer', 'cssmin' ] );
 
+	// Incremental build, only rebuilds what changed since the last run
+	grunt.registerTask( 'build', [ 'incremental' ] );
+
 	// Package presentation to archive
-	grunt.registerTask( 'package', [ 'default', 'zip' ] );
+	grunt.registerTask( 'package', [ 'default', 'searchindex', 'zip' ] );
 
 	// Serve presentation locally
 	grunt.registerTask( 'serve', [ 'connect', 'watch' ] );
@@ -146,6 +146,21 @@
 			// Number of slides away from the current that are visible
 			viewDistance: 3,
 
+			// Detach the contents of slides outside of the view distance
+			// from the DOM and release their backgrounds, restoring them
+			// as the presentation is navigated
+			virtualize: false,
+
+			// Splits the horizontal slides into this many consecutive
+			// parts when printing to PDF and only prints the zero-based
+			// pdfPart, used to export large presentations in parallel
+			pdfPart: 0,
+			pdfParts: 1,
+
+			// Number of slides away from the current at which deferred
+			// dependencies needed by those slides start loading
+			prefetchDistance: 2,
+
 			// Script dependencies to load
 			dependencies: []
 
@@ -157,6 +172,13 @@
 		// Flags if the overview mode is currently active
 		overview = false,
 
+		// Dependencies flagged with defer, they are not loaded before
+		// #start() but by #loadDeferredDependencies()
+		deferredDependencies = [],
+
+		// Flags if slide contents may be detached, see #virtualizeSlides()
+		slidesVirtualized = false,
+
 		// The horizontal and vertical index of the currently active slide
 		indexh,
 		indexv,
@@ -179,6 +201,13 @@
 		// split into two groups
 		slidesTransform = { layout: '', overview: '' },
 
+		// Measurements reused by #layout() until #invalidateLayout()
+		// is called, see #getSlideHeight()
+		layoutCache = { version: 0, size: null },
+
+		// Pending animation frame of #requestLayout()
+		layoutFrame = 0,
+
 		// Cached references to DOM elements
 		dom = {},
 
@@ -266,7 +295,7 @@
 		dom.slides = document.querySelector( '.reveal .slides' );
 
 		// Force a layout when the whole page, incl fonts, has loaded
-		window.addEventListener( 'load', layout, false );
+		window.addEventListener( 'load', forceLayout, false );
 
 		var query = Reveal.getQueryHash();
 
@@ -360,14 +389,17 @@
 
 			// Load if there's no condition or the condition is truthy
 			if( !s.condition || s.condition() ) {
-				if( s.async ) {
+				if( s.defer ) {
+					deferredDependencies.push( s );
+				}
+				else if( s.async ) {
 					scriptsAsync.push( s.src );
 				}
 				else {
 					scripts.push( s.src );
 				}
 
-				loadScript( s );
+				if( !s.defer ) loadScript( s );
 			}
 		}
 
@@ -383,6 +415,42 @@
 
 	}
 
+	/**
+	 * Loads the deferred dependencies whose selector matches the
+	 * content of a slide within the prefetch distance.
+	 *
+	 * @param {Boolean} all Load all deferred dependencies
+	 */
+	function loadDeferredDependencies( all ) {
+
+		if( !deferredDependencies.length ) return;
+
+		var horizontalSlides = toArray( dom.wrapper.querySelectorAll( HORIZONTAL_SLIDES_SELECTOR ) );
+
+		deferredDependencies = deferredDependencies.filter( function( s ) {
+			var needed = all || ( s.selector && horizontalSlides.some( function( hslide, x ) {
+				return Math.abs( ( indexh || 0 ) - x ) <= config.prefetchDistance && querySlide( hslide, s.selector ).length > 0;
+			} ) );
+
+			if( needed ) {
+				head.js( s.src, function() {
+					// Extension may contain callback functions
+					if( typeof s.callback === 'function' ) {
+						s.callback.apply( this );
+					}
+
+					// The slides were measured before the plugin could
+					// change them
+					invalidateLayout();
+					requestLayout();
+				} );
+			}
+
+			return !needed;
+		} );
+
+	}
+
 	/**
 	 * Starts up reveal.js by binding input events and navigating
 	 * to the current URL deeplink if there is one.
@@ -425,6 +493,33 @@
 			} );
 		}, 1 );
 
+		// Deferred dependencies that no nearby slide needs are loaded
+		// once the browser is idle, or right away when printing
+		if( isPrintingPDF() ) {
+			loadDeferredDependencies( true );
+		}
+		else if( typeof window.requestIdleCallback === 'function' ) {
+			window.requestIdleCallback( function() {
+				loadDeferredDependencies( true );
+			} );
+		}
+		else {
+			setTimeout( function() {
+				loadDeferredDependencies( true );
+			}, 1000 );
+		}
+
+		// Plugins which process the slides when the page has loaded
+		// need to see all of them
+		if( document.readyState === 'complete' ) {
+			setTimeout( virtualizeSlides, 0 );
+		}
+		else {
+			window.addEventListener( 'load', function() {
+				setTimeout( virtualizeSlides, 0 );
+			}, false );
+		}
+
 		// Special setup and config is required when printing to PDF
 		if( isPrintingPDF() ) {
 			removeEventListeners();
@@ -490,6 +585,10 @@
 		dom.controlsNext = toArray( document.querySelectorAll( '.navigate-next' ) );
 
 		dom.statusDiv = createStatusDiv();
+
+		// Media loading inside of a slide changes its size. The load
+		// event doesn't bubble so it's captured instead
+		dom.slides.addEventListener( 'load', onSlideContentLoaded, true );
 	}
 
 	/**
@@ -555,6 +654,18 @@
 			}
 		} );
 
+		// Only keep the requested part of the presentation, slide
+		// numbers were assigned above so they still match the full deck
+		if( config.pdfParts > 1 ) {
+			var horizontalSlides = toArray( dom.wrapper.querySelectorAll( HORIZONTAL_SLIDES_SELECTOR ) );
+
+			horizontalSlides.forEach( function( hslide, h ) {
+				if( Math.floor( h * config.pdfParts / horizontalSlides.length ) !== config.pdfPart ) {
+					hslide.parentNode.removeChild( hslide );
+				}
+			} );
+		}
+
 		// Slide and slide background layout
 		toArray( dom.wrapper.querySelectorAll( SLIDES_SELECTOR ) ).forEach( function( slide ) {
 
@@ -806,9 +917,26 @@
 		slide.classList.remove( 'has-dark-background' );
 		slide.classList.remove( 'has-light-background' );
 
-		// If this slide has a background color, add a class that
-		// signals if it is light or dark. If the slide has no background
-		// color, no class will be set
+		// Reading the computed style is costly, virtualized backgrounds
+		// are checked once they come within the view distance
+		if( !config.virtualize ) {
+			updateBackgroundBrightness( slide, element );
+		}
+
+		return element;
+
+	}
+
+	/**
+	 * If the background of this slide has a color, add a class
+	 * to the slide that signals if it is light or dark. If the
+	 * slide has no background color, no class will be set.
+	 *
+	 * @param {HTMLElement} slide
+	 * @param {HTMLElement} element The background of the slide
+	 */
+	function updateBackgroundBrightness( slide, element ) {
+
 		var computedBackgroundColor = window.getComputedStyle( element ).backgroundColor;
 		if( computedBackgroundColor ) {
 			var rgb = colorToRgb( computedBackgroundColor );
@@ -826,8 +954,6 @@
 			}
 		}
 
-		return element;
-
 	}
 
 	/**
@@ -954,9 +1080,20 @@
 			autoSlidePaused = false;
 		}
 
+		// Bring back detached slide contents if virtualization was
+		// configured off
+		if( !config.virtualize ) {
+			slidesVirtualized = false;
+
+			toArray( dom.slides.querySelectorAll( 'section' ) ).forEach( restoreSlideContent );
+		}
+		else if( loaded && document.readyState === 'complete' && !isPrintingPDF() ) {
+			slidesVirtualized = true;
+		}
+
 		// When fragments are turned off they should be visible
 		if( config.fragments === false ) {
-			toArray( dom.slides.querySelectorAll( '.fragment' ) ).forEach( function( element ) {
+			querySlide( dom.slides, '.fragment' ).forEach( function( element ) {
 				element.classList.add( 'visible' );
 				element.classList.remove( 'current-fragment' );
 			} );
@@ -1109,6 +1246,30 @@
 
 	}
 
+	/**
+	 * Same as querySelectorAll() on the given slide element but
+	 * also looks inside of the detached contents of any slide
+	 * it contains.
+	 *
+	 * @param {HTMLElement} slide
+	 * @param {String} selector
+	 *
+	 * @return {Array} Matching elements
+	 */
+	function querySlide( slide, selector ) {
+
+		var elements = toArray( slide.querySelectorAll( selector ) );
+
+		[ slide ].concat( toArray( slide.querySelectorAll( 'section' ) ) ).forEach( function( section ) {
+			if( section.virtualContent ) {
+				elements = elements.concat( toArray( section.virtualContent.querySelectorAll( selector ) ) );
+			}
+		} );
+
+		return elements;
+
+	}
+
 	/**
 	 * Utility for deserializing a value.
 	 */
@@ -1559,7 +1720,9 @@
 
 		if( dom.wrapper && !isPrintingPDF() ) {
 
-			var size = getComputedSlideSize();
+			// Reading the presentation size forces a reflow, it only
+			// changes when the window is resized
+			var size = layoutCache.size || ( layoutCache.size = getComputedSlideSize() );
 
 			var slidePadding = 20; // TODO Dig this out of DOM
 
@@ -1608,32 +1771,33 @@
 				}
 			}
 
-			// Select all slides, vertical and horizontal
-			var slides = toArray( dom.wrapper.querySelectorAll( SLIDES_SELECTOR ) );
+			// Select all slides, vertical and horizontal. Don't bother
+			// updating invisible slides
+			var slides = toArray( dom.wrapper.querySelectorAll( SLIDES_SELECTOR ) ).filter( function( slide ) {
+				return slide.style.display !== 'none';
+			} );
 
-			for( var i = 0, len = slides.length; i < len; i++ ) {
-				var slide = slides[ i ];
-
-				// Don't bother updating invisible slides
-				if( slide.style.display === 'none' ) {
-					continue;
-				}
+			// Measure every slide before moving any of them so that the
+			// browser reflows at most once
+			var offsets = slides.map( function( slide ) {
 
 				if( config.center || slide.classList.contains( 'center' ) ) {
 					// Vertical stacks are not centred since their section
 					// children will be
 					if( slide.classList.contains( 'stack' ) ) {
-						slide.style.top = 0;
+						return 0;
 					}
-					else {
-						slide.style.top = Math.max( ( ( size.height - getAbsoluteHeight( slide ) ) / 2 ) - slidePadding, 0 ) + 'px';
-					}
-				}
-				else {
-					slide.style.top = '';
+
+					return Math.max( ( ( size.height - getSlideHeight( slide, size ) ) / 2 ) - slidePadding, 0 ) + 'px';
 				}
 
-			}
+				return '';
+
+			} );
+
+			slides.forEach( function( slide, i ) {
+				slide.style.top = offsets[i];
+			} );
 
 			updateProgress();
 			updateParallax();
@@ -1642,17 +1806,92 @@
 
 	}
 
+	/**
+	 * Lays out the presentation from scratch, measuring all
+	 * content again.
+	 */
+	function forceLayout() {
+
+		invalidateLayout();
+		layout();
+
+	}
+
+	/**
+	 * Schedules a #layout() for the next animation frame, multiple
+	 * requests within the same frame result in a single layout.
+	 */
+	function requestLayout() {
+
+		if( features.requestAnimationFrame ) {
+			if( !layoutFrame ) {
+				layoutFrame = features.requestAnimationFrameMethod.call( window, function() {
+					layoutFrame = 0;
+					layout();
+				} );
+			}
+		}
+		else {
+			layout();
+		}
+
+	}
+
+	/**
+	 * Discards the measurements cached by #layout(). Needs to be
+	 * called whenever the size of the presentation or of the slide
+	 * contents may have changed.
+	 */
+	function invalidateLayout() {
+
+		layoutCache.version += 1;
+		layoutCache.size = null;
+
+	}
+
+	/**
+	 * Returns the height of the given slide's content, measured
+	 * once per slide size and layout cache version.
+	 *
+	 * @param {HTMLElement} slide
+	 * @param {Object} size As returned by #getComputedSlideSize()
+	 */
+	function getSlideHeight( slide, size ) {
+
+		var key = layoutCache.version + ':' + size.width + 'x' + size.height;
+
+		if( !slide.layoutMeasurement || slide.layoutMeasurement.key !== key ) {
+			slide.layoutMeasurement = { key: key, height: getAbsoluteHeight( slide ) };
+		}
+
+		return slide.layoutMeasurement.height;
+
+	}
+
 	/**
 	 * Applies layout logic to the contents of all slides in
 	 * the presentation.
 	 */
 	function layoutSlideContents( width, height, padding ) {
 
-		// Handle sizing of elements with the 'stretch' class
-		toArray( dom.slides.querySelectorAll( 'section > .stretch' ) ).forEach( function( element ) {
+		var key = layoutCache.version + ':' + width + 'x' + height;
+
+		// Handle sizing of elements with the 'stretch' class, unless
+		// they were already sized since the last invalidation. Elements
+		// of hidden slides can't be measured, they are sized once their
+		// slide is shown
+		var elements = toArray( dom.slides.querySelectorAll( 'section > .stretch' ) ).filter( function( element ) {
+			return element.layoutMeasurement !== key && element.parentNode.offsetHeight !== 0;
+		} );
+
+		// Determine how much vertical space we can use
+		var remainingHeights = elements.map( function( element ) {
+			return getRemainingHeight( element, height );
+		} );
+
+		elements.forEach( function( element, i ) {
 
-			// Determine how much vertical space we can use
-			var remainingHeight = getRemainingHeight( element, height );
+			var remainingHeight = remainingHeights[i];
 
 			// Consider the aspect ratio of media elements
 			if( /(img|video)/gi.test( element.nodeName ) ) {
@@ -1664,10 +1903,18 @@
 				element.style.width = ( nw * es ) + 'px';
 				element.style.height = ( nh * es ) + 'px';
 
+				// Media that hasn't loaded yet is measured again once
+				// it has, see #onSlideContentLoaded()
+				if( nw && nh ) {
+					element.layoutMeasurement = key;
+				}
+
 			}
 			else {
 				element.style.width = width + 'px';
 				element.style.height = remainingHeight + 'px';
+
+				element.layoutMeasurement = key;
 			}
 
 		} );
@@ -2122,7 +2369,10 @@
 		// Update the visibility of slides now that the indices have changed
 		updateSlidesVisibility();
 
-		layout();
+		// Fetch the plugins needed by the upcoming slides
+		loadDeferredDependencies();
+
+		requestLayout();
 
 		// Apply the new state
 		stateLoop: for( var i = 0, len = state.length; i < len; i++ ) {
@@ -2238,7 +2488,7 @@
 		addEventListeners();
 
 		// Force a layout to make sure the current config is accounted for
-		layout();
+		forceLayout();
 
 		// Reflect the current autoSlide value
 		autoSlide = config.autoSlide;
@@ -2307,11 +2557,11 @@
 			var verticalSlides = toArray( horizontalSlide.querySelectorAll( 'section' ) );
 			verticalSlides.forEach( function( verticalSlide, y ) {
 
-				sortFragments( verticalSlide.querySelectorAll( '.fragment' ) );
+				sortFragments( querySlide( verticalSlide, '.fragment' ) );
 
 			} );
 
-			if( verticalSlides.length === 0 ) sortFragments( horizontalSlide.querySelectorAll( '.fragment' ) );
+			if( verticalSlides.length === 0 ) sortFragments( querySlide( horizontalSlide, '.fragment' ) );
 
 		} );
 
@@ -2382,7 +2632,7 @@
 					element.classList.add( reverse ? 'future' : 'past' );
 
 					if( config.fragments ) {
-						var pastFragments = toArray( element.querySelectorAll( '.fragment' ) );
+						var pastFragments = querySlide( element, '.fragment' );
 
 						// Show all fragments on prior slides
 						while( pastFragments.length ) {
@@ -2397,7 +2647,7 @@
 					element.classList.add( reverse ? 'past' : 'future' );
 
 					if( config.fragments ) {
-						var futureFragments = toArray( element.querySelectorAll( '.fragment.visible' ) );
+						var futureFragments = querySlide( element, '.fragment.visible' );
 
 						// No fragments in future slides should be visible ahead of time
 						while( futureFragments.length ) {
@@ -2833,6 +3083,8 @@
 		// Show the slide element
 		slide.style.display = 'block';
 
+		restoreSlideContent( slide );
+
 		// Media elements with data-src attributes
 		toArray( slide.querySelectorAll( 'img[data-src], video[data-src], audio[data-src]' ) ).forEach( function( element ) {
 			element.setAttribute( 'src', element.getAttribute( 'data-src' ) );
@@ -2867,6 +3119,10 @@
 			if( background.hasAttribute( 'data-loaded' ) === false ) {
 				background.setAttribute( 'data-loaded', 'true' );
 
+				if( config.virtualize ) {
+					updateBackgroundBrightness( slide, background );
+				}
+
 				var backgroundImage = slide.getAttribute( 'data-background-image' ),
 					backgroundVideo = slide.getAttribute( 'data-background-video' ),
 					backgroundVideoLoop = slide.hasAttribute( 'data-background-video-loop' ),
@@ -2921,6 +3177,63 @@
 		var background = getSlideBackground( indices.h, indices.v );
 		if( background ) {
 			background.style.display = 'none';
+
+			// Release the background media, it's loaded again by
+			// #showSlide(). Backgrounds set from data-background are
+			// applied once by #createBackground() and kept
+			if( config.virtualize && background.hasAttribute( 'data-loaded' ) ) {
+				background.removeAttribute( 'data-loaded' );
+
+				if( slide.hasAttribute( 'data-background-image' ) ) {
+					background.style.backgroundImage = '';
+				}
+
+				toArray( background.childNodes ).forEach( function( child ) {
+					if( /^(video|iframe)$/i.test( child.nodeName ) ) {
+						background.removeChild( child );
+					}
+				} );
+			}
+		}
+
+		// Stacks keep their vertical slides, which are
+		// detached one by one
+		if( slidesVirtualized && !slide.virtualContent && !slide.querySelector( 'section' ) ) {
+			var content = document.createDocumentFragment();
+
+			while( slide.firstChild ) {
+				content.appendChild( slide.firstChild );
+			}
+
+			slide.virtualContent = content;
+		}
+
+	}
+
+	/**
+	 * Puts back the contents of a slide detached by
+	 * #hideSlide().
+	 */
+	function restoreSlideContent( slide ) {
+
+		if( slide.virtualContent ) {
+			slide.appendChild( slide.virtualContent );
+			slide.virtualContent = null;
+			slide.layoutMeasurement = null;
+		}
+
+	}
+
+	/**
+	 * Starts detaching the contents of slides that are outside
+	 * of the view distance. Waits until the page has loaded so
+	 * that plugins see every slide first.
+	 */
+	function virtualizeSlides() {
+
+		if( config.virtualize && !isPrintingPDF() ) {
+			slidesVirtualized = true;
+			updateSlidesVisibility();
 		}
 
 	}
@@ -3409,7 +3722,7 @@
 		}
 
 		// ... or using an <aside class="notes"> element
-		var notesElement = slide.querySelector( 'aside.notes' );
+		var notesElement = querySlide( slide, 'aside.notes' )[0];
 		if( notesElement ) {
 			return notesElement.innerHTML;
 		}
@@ -4251,7 +4564,18 @@
 	 */
 	function onWindowResize( event ) {
 
-		layout();
+		invalidateLayout();
+		requestLayout();
+
+	}
+
+	/**
+	 * Handler for 'load' events of media inside of the slides.
+	 */
+	function onSlideContentLoaded( event ) {
+
+		invalidateLayout();
+		requestLayout();
 
 	}
 
@@ -4544,7 +4868,7 @@
 		navigateNext: navigateNext,
 
 		// Forces an update in slide layout
-		layout: layout,
+		layout: forceLayout,
 
 		// Returns an object with the available routes as booleans (left/right/top/bottom)
 		availableRoutes: availableRoutes,
@@ -33,6 +33,8 @@
 
 	var SCRIPT_END_PLACEHOLDER = '__SCRIPT_END__';
 
+	var VOID_ELEMENTS = /^(area|base|br|col|embed|hr|img|input|keygen|link|meta|param|source|track|wbr)$/i;
+
 
 	/**
 	 * Retrieves the markdown contents of a slide section
@@ -42,8 +44,16 @@
 
 		var template = section.querySelector( 'script' );
 
-		// strip leading whitespace so it isn't evaluated as code
-		var text = ( template || section ).textContent;
+		return normalizeMarkdown( ( template || section ).textContent );
+
+	}
+
+	/**
+	 * Restores script end tags and strips the leading
+	 * whitespace of a markdown template so it isn't
+	 * evaluated as code.
+	 */
+	function normalizeMarkdown( text ) {
 
 		// restore script end tags
 		text = text.replace( new RegExp( SCRIPT_END_PLACEHOLDER, 'g' ), '</script>' );
@@ -108,13 +118,23 @@
 	}
 
 	/**
-	 * Helper function for constructing a markdown slide.
+	 * Splits the speaker notes from the content of a slide,
+	 * returns [ content, notes ] if the slide has notes.
 	 */
-	function createMarkdownSlide( content, options ) {
+	function splitNotes( content, options ) {
 
 		options = getSlidifyOptions( options );
 
-		var notesMatch = content.split( new RegExp( options.notesSeparator, 'mgi' ) );
+		return content.split( new RegExp( options.notesSeparator, 'mgi' ) );
+
+	}
+
+	/**
+	 * Helper function for constructing a markdown slide.
+	 */
+	function createMarkdownSlide( content, options ) {
+
+		var notesMatch = splitNotes( content, options );
 
 		if( notesMatch.length === 2 ) {
 			content = notesMatch[0] + '<aside class="notes" data-markdown>' + notesMatch[1].trim() + '</aside>';
@@ -129,10 +149,11 @@
 	}
 
 	/**
-	 * Parses a data string into multiple slides based
-	 * on the passed in separator arguments.
+	 * Splits a data string on the passed in separator
+	 * arguments. Returns the list of horizontal slides, where
+	 * vertical stacks are arrays of slides.
 	 */
-	function slidify( markdown, options ) {
+	function splitSlides( markdown, options ) {
 
 		options = getSlidifyOptions( options );
 
@@ -177,7 +198,20 @@
 		// add the remaining slide
 		( wasHorizontal ? sectionStack : sectionStack[sectionStack.length-1] ).push( markdown.substring( lastIndex ) );
 
-		var markdownSections = '';
+		return sectionStack;
+
+	}
+
+	/**
+	 * Parses a data string into multiple slides based
+	 * on the passed in separator arguments.
+	 */
+	function slidify( markdown, options ) {
+
+		options = getSlidifyOptions( options );
+
+		var sectionStack = splitSlides( markdown, options ),
+			markdownSections = '';
 
 		// flatten the hierarchical stack, and insert <section data-markdown> tags
 		for( var i = 0, len = sectionStack.length; i < len; i++ ) {
@@ -384,6 +418,267 @@
 
 	}
 
+	/**
+	 * Splits the attributes of an HTML start tag into a list
+	 * of { name, value, source } where source is the attribute
+	 * as written.
+	 */
+	function parseAttributes( source ) {
+
+		var attributeRegex = /([^\s=\/>"']+)(?:\s*=\s*(?:"([^"]*)"|'([^']*)'|([^\s>"']+)))?/g,
+			attributes = [],
+			match;
+
+		while( match = attributeRegex.exec( source ) ) {
+			var value = match[2] !== undefined ? match[2] : match[3] !== undefined ? match[3] : match[4] || '';
+
+			attributes.push( {
+				name: match[1].toLowerCase(),
+				value: value.replace( /&quot;/g, '"' ).replace( /&#39;/g, '\'' ).replace( /&lt;/g, '<' ).replace( /&gt;/g, '>' ).replace( /&amp;/g, '&' ),
+				source: match[0]
+			} );
+		}
+
+		return attributes;
+
+	}
+
+	/**
+	 * Equivalent of getAttribute() for a list returned by
+	 * parseAttributes(), null if the attribute is missing.
+	 */
+	function findAttribute( attributes, name ) {
+
+		for( var i = 0, len = attributes.length; i < len; i++ ) {
+			if( attributes[i].name === name ) return attributes[i].value;
+		}
+
+		return null;
+
+	}
+
+	/**
+	 * Builds a section start tag from a list of parsed attributes,
+	 * with the values in overrides replacing or extending them.
+	 */
+	function createSectionTag( attributes, overrides ) {
+
+		var result = [];
+
+		attributes.forEach( function( attribute ) {
+			if( !overrides.hasOwnProperty( attribute.name ) ) result.push( attribute.source );
+		} );
+
+		for( var name in overrides ) {
+			result.push( name + '="' + overrides[name] + '"' );
+		}
+
+		return '<section' + ( result.length ? ' ' + result.join( ' ' ) : '' ) + '>';
+
+	}
+
+	/**
+	 * String counterpart of addAttributeInElement(), returns the
+	 * comment text with the attributes pattern removed, or null
+	 * if it doesn't match.
+	 */
+	function addAttributeInObject( text, target, separator ) {
+
+		var mardownClassesInElementsRegex = new RegExp( separator, 'mg' );
+		var mardownClassRegex = new RegExp( "([^\"= ]+?)=\"([^\"=]+?)\"", 'mg' );
+		var matches = mardownClassesInElementsRegex.exec( text ),
+			matchesClass;
+
+		if( matches ) {
+			while( matchesClass = mardownClassRegex.exec( matches[1] ) ) {
+				target[ matchesClass[1] ] = matchesClass[2];
+			}
+			return text.substring( 0, matches.index ) + text.substring( mardownClassesInElementsRegex.lastIndex );
+		}
+
+		return null;
+
+	}
+
+	/**
+	 * String counterpart of addAttributes(), applies the attributes
+	 * found in the comments of the HTML generated for one slide
+	 * without needing a DOM. Element attributes go to the previous
+	 * sibling element of the comment (or its parent), slide attributes
+	 * are returned to be set on the slide's section.
+	 */
+	function addAttributesToHTML( html, separatorElementAttributes, separatorSectionAttributes ) {
+
+		var tokenRegex = /<!--([\s\S]*?)-->|<\/([a-zA-Z][\w:-]*)[^>]*>|<([a-zA-Z][\w:-]*)(?:[^>"']|"[^"]*"|'[^']*')*>/g,
+			section = { children: [], attributes: {} },
+			stack = [ section ],
+			elements = [],
+			replacements = [],
+			match;
+
+		while( match = tokenRegex.exec( html ) ) {
+			var parent = stack[ stack.length - 1 ];
+
+			if( match[1] !== undefined ) {
+				var target = parent.children[ parent.children.length - 1 ] || parent,
+					text = addAttributeInObject( match[1], target.attributes, separatorElementAttributes );
+
+				if( text === null ) {
+					text = addAttributeInObject( match[1], section.attributes, separatorSectionAttributes );
+				}
+
+				if( text !== null ) {
+					replacements.push( { index: match.index, length: match[0].length, html: '<!--' + text + '-->' } );
+				}
+			}
+			else if( match[2] !== undefined ) {
+				// tolerate unclosed elements the same way the browser would
+				for( var i = stack.length - 1; i > 0; i-- ) {
+					if( stack[i].tagName === match[2].toLowerCase() ) {
+						stack.length = i;
+						break;
+					}
+				}
+			}
+			else {
+				var element = { tagName: match[3].toLowerCase(), index: match.index, source: match[0], children: [], attributes: {} };
+
+				// line breaks never receive attributes
+				if( element.tagName !== 'br' ) parent.children.push( element );
+				elements.push( element );
+
+				if( !VOID_ELEMENTS.test( element.tagName ) && !/\/>$/.test( element.source ) ) {
+					stack.push( element );
+				}
+			}
+		}
+
+		elements.forEach( function( element ) {
+			var tag = element.source,
+				name;
+
+			for( name in element.attributes ) {
+				tag = tag.replace( new RegExp( '\\s' + name.replace( /[-\/\\^$*+?.()|[\]{}]/g, '\\$&' ) + '(\\s*=\\s*("[^"]*"|\'[^\']*\'|[^\\s"\'>]+))?(?=[\\s\/>])', 'i' ), '' );
+				tag = tag.replace( /\s*(\/?>)$/, ' ' + name + '="' + element.attributes[name] + '"$1' );
+			}
+
+			if( tag !== element.source ) {
+				replacements.push( { index: element.index, length: element.source.length, html: tag } );
+			}
+		} );
+
+		replacements.sort( function( a, b ) { return b.index - a.index; } ).forEach( function( replacement ) {
+			html = html.substring( 0, replacement.index ) + replacement.html + html.substring( replacement.index + replacement.length );
+		} );
+
+		return { html: html, attributes: section.attributes };
+
+	}
+
+	/**
+	 * Converts the markdown of a single slide to HTML, the same
+	 * way convertSlides() does in the browser.
+	 */
+	function compileSlide( content, options ) {
+
+		var notesMatch = splitNotes( normalizeMarkdown( content ), options ),
+			slide = addAttributesToHTML( marked( notesMatch[0] ), options.elementAttributes, options.slideAttributes );
+
+		if( notesMatch.length === 2 ) {
+			slide.html += '<aside class="notes">' + marked( notesMatch[1].trim() ) + '</aside>';
+		}
+
+		return slide;
+
+	}
+
+	/**
+	 * Compiles the markdown slides of a presentation ahead of
+	 * time, turning every <section data-markdown> into final
+	 * <section> HTML so that neither this plugin nor marked are
+	 * needed at runtime.
+	 *
+	 * External markdown files are read through options.readFile( url, charset ),
+	 * sections that can't be compiled are left untouched for the runtime
+	 * path to handle and reported to options.warn( message ).
+	 *
+	 * @param {String} html Source of the presentation
+	 * @param {Object} options
+	 */
+	function compile( html, options ) {
+
+		options = options || {};
+
+		var warn = options.warn || function() {};
+
+		return html.replace( /<!--[\s\S]*?-->|<section\b(?=(?:[^>"']|"[^"]*"|'[^']*')*\bdata-markdown\b)((?:[^>"']|"[^"]*"|'[^']*')*)>([\s\S]*?)<\/section>/gi, function( match, attributeSource, content ) {
+
+			if( attributeSource === undefined ) return match;
+
+			var attributes = parseAttributes( attributeSource ),
+				url = findAttribute( attributes, 'data-markdown' ),
+				markdown;
+
+			if( url === null ) return match;
+
+			var slideOptions = getSlidifyOptions( {
+				separator: findAttribute( attributes, 'data-separator' ),
+				verticalSeparator: findAttribute( attributes, 'data-separator-vertical' ),
+				notesSeparator: findAttribute( attributes, 'data-separator-notes' ),
+				elementAttributes: findAttribute( attributes, 'data-element-attributes' ) || DEFAULT_ELEMENT_ATTRIBUTES_SEPARATOR,
+				slideAttributes: findAttribute( attributes, 'data-attributes' ) || DEFAULT_SLIDE_ATTRIBUTES_SEPARATOR
+			} );
+
+			if( url.length ) {
+				try {
+					markdown = options.readFile ? options.readFile( url, findAttribute( attributes, 'data-charset' ) ) : null;
+				}
+				catch( e ) {
+					markdown = null;
+				}
+
+				if( typeof markdown !== 'string' ) {
+					warn( 'Could not read the Markdown file ' + url + ', leaving it to be loaded at runtime' );
+					return match;
+				}
+			}
+			else {
+				var template = content.match( /<script\b[^>]*>([\s\S]*?)<\/script>/i );
+
+				markdown = normalizeMarkdown( template ? template[1] : content );
+
+				// a single slide keeps its section and attributes
+				if( !findAttribute( attributes, 'data-separator' ) && !findAttribute( attributes, 'data-separator-vertical' ) && !findAttribute( attributes, 'data-separator-notes' ) ) {
+					var slide = compileSlide( markdown, getSlidifyOptions( { elementAttributes: slideOptions.elementAttributes, slideAttributes: slideOptions.slideAttributes } ) );
+
+					return createSectionTag( attributes.filter( function( attribute ) {
+						return attribute.name !== 'data-markdown';
+					} ), slide.attributes ) + slide.html + '</section>';
+				}
+			}
+
+			// disregard attributes that are used for markdown loading/parsing
+			var forwarded = attributes.filter( function( attribute ) {
+				return !/data\-(markdown|separator|vertical|notes)/i.test( attribute.name );
+			} );
+
+			return splitSlides( markdown, slideOptions ).map( function( section ) {
+				// vertical
+				if( section instanceof Array ) {
+					return createSectionTag( forwarded, {} ) + section.map( function( child ) {
+						var slide = compileSlide( child, slideOptions );
+						return createSectionTag( [], slide.attributes ) + slide.html + '</section>';
+					} ).join( '' ) + '</section>';
+				}
+
+				var slide = compileSlide( section, slideOptions );
+				return createSectionTag( forwarded, slide.attributes ) + slide.html + '</section>';
+			} ).join( '' );
+
+		} );
+
+	}
+
 	// API
 	return {
 
@@ -395,7 +690,10 @@
 		// TODO: Do these belong in the API?
 		processSlides: processSlides,
 		convertSlides: convertSlides,
-		slidify: slidify
+		slidify: slidify,
+
+		// Ahead of time compilation of markdown slides
+		compile: compile
 
 	};
 
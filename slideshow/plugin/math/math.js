@@ -30,6 +30,7 @@ var RevealMath = window.RevealMath || (function(){
 		Reveal.addEventListener( 'slidechanged', function( event ) {
 
 			MathJax.Hub.Queue( [ 'Typeset', MathJax.Hub, event.currentSlide ] );
+			MathJax.Hub.Queue( Reveal.layout );
 
 		} );
 
@@ -16,12 +16,20 @@ var opts = {
 };
 
 io.on( 'connection', function( socket ) {
+	// The master sends the same secret with every state change, so
+	// remember the last one verified on this connection instead of
+	// running the cipher again for each slide change
+	var verified = { secret: null, socketId: null };
+
 	socket.on('multiplex-statechanged', function(data) {
 		if (typeof data.secret == 'undefined' || data.secret == null || data.secret === '') return;
-		if (createHash(data.secret) === data.socketId) {
-			data.secret = null;
-			socket.broadcast.emit(data.socketId, data);
-		};
+		if (data.secret !== verified.secret || data.socketId !== verified.socketId) {
+			if (createHash(data.secret) !== data.socketId) return;
+			verified.secret = data.secret;
+			verified.socketId = data.socketId;
+		}
+		data.secret = null;
+		socket.broadcast.emit(data.socketId, data);
 	});
 });
 
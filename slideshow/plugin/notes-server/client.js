@@ -4,7 +4,8 @@
 	if( window.location.search.match( /receiver/gi ) ) { return; }
 
 	var socket = io.connect( window.location.origin ),
-		socketId = Math.random().toString().slice( 2 );
+		socketId = Math.random().toString().slice( 2 ),
+		speakerState = {};
 
 	console.log( 'View slide notes at ' + window.location.origin + '/notes/' + socketId );
 
@@ -47,6 +48,14 @@
 
 	// When the state changes from inside of the speaker view
 	socket.on( 'statechanged-speaker', function( data ) {
+		// Coalesced frames only carry the fields that changed
+		if( data.delta ) {
+			for( var field in data.state ) {
+				speakerState[field] = data.state[field];
+			}
+			data.state = speakerState;
+		}
+
 		Reveal.setState( data.state );
 	} );
 
@@ -13,21 +13,119 @@ io = io(server);
 
 var opts = {
 	port :      1947,
-	baseDir :   __dirname + '/../../'
+	baseDir :   __dirname + '/../../',
+	// Time window (ms) over which state changes are merged before being
+	// relayed. 0 forwards every event as it arrives.
+	coalesce :  parseInt( process.env.NOTES_COALESCE, 10 ) || 0
 };
 
+var STATE_FIELDS = [ 'indexh', 'indexv', 'indexf', 'paused', 'overview' ];
+
+/**
+ * Relays state events to one socket, merging everything received
+ * within opts.coalesce ms into a single frame. Only the state fields
+ * that differ from what this socket last received are sent, and
+ * nothing is written while its previous frames are still buffered, so
+ * a slow client just skips intermediate states.
+ */
+function Relay( socket ) {
+
+	this.socket = socket;
+	this.pending = {};
+	this.sent = {};
+	this.timeout = null;
+	this.flushing = false;
+
+	socket.conn.on( 'drain', this.flush.bind( this ) );
+
+}
+
+Relay.prototype.push = function( eventName, data ) {
+
+	var key = eventName + ':' + ( data.socketId || '' ),
+		pending = this.pending[key];
+
+	if( pending ) {
+		_.extend( pending.data.state, data.state );
+		pending.data = _.extend( {}, data, { state: pending.data.state } );
+	}
+	else {
+		this.pending[key] = {
+			eventName: eventName,
+			data: _.extend( {}, data, { state: _.extend( {}, data.state ) } )
+		};
+	}
+
+	if( !this.timeout ) {
+		this.timeout = setTimeout( this.flush.bind( this ), opts.coalesce );
+	}
+
+};
+
+Relay.prototype.flush = function() {
+
+	clearTimeout( this.timeout );
+	this.timeout = null;
+
+	// Emitting may drain synchronously and call back into #flush()
+	if( this.flushing ) return;
+
+	// Wait for the 'drain' event if this client is falling behind
+	if( this.socket.conn.writeBuffer.length ) return;
+
+	var pending = this.pending;
+	this.pending = {};
+	this.flushing = true;
+
+	_.each( pending, function( pending, key ) {
+
+		var sent = this.sent[key] || {},
+			delta = _.pick( pending.data.state, function( value, field ) {
+				return _.contains( STATE_FIELDS, field ) && sent[field] !== value;
+			} );
+
+		if( _.isEmpty( delta ) ) return;
+
+		this.sent[key] = _.extend( sent, delta );
+		this.socket.emit( pending.eventName, _.extend( pending.data, { state: delta, delta: true } ) );
+
+	}, this );
+
+	this.flushing = false;
+
+};
+
+function relay( origin, eventName, data ) {
+
+	if( !opts.coalesce ) {
+		origin.broadcast.emit( eventName, data );
+		return;
+	}
+
+	_.each( io.sockets.sockets, function( socket ) {
+		if( socket !== origin ) socket.relay.push( eventName, data );
+	} );
+
+}
+
 io.on( 'connection', function( socket ) {
 
+	socket.relay = new Relay( socket );
+
 	socket.on( 'new-subscriber', function( data ) {
 		socket.broadcast.emit( 'new-subscriber', data );
 	});
 
 	socket.on( 'statechanged', function( data ) {
-		socket.broadcast.emit( 'statechanged', data );
+		relay( socket, 'statechanged', data );
 	});
 
 	socket.on( 'statechanged-speaker', function( data ) {
-		socket.broadcast.emit( 'statechanged-speaker', data );
+		relay( socket, 'statechanged-speaker', data );
+	});
+
+	socket.on( 'disconnect', function() {
+		clearTimeout( socket.relay.timeout );
 	});
 
 });
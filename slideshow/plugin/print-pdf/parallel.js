@@ -0,0 +1,116 @@
+/**
+ * Exports a presentation to PDF using several PhantomJS processes at
+ * once. Each process prints a consecutive part of the horizontal slides
+ * (see the pdfPart and pdfParts config options) and the parts are then
+ * merged into a single file.
+ *
+ * Merging uses Ghostscript when available, which also stores images
+ * repeated across slides (backgrounds, logos) only once. pdfunite from
+ * poppler is used otherwise.
+ *
+ * Example:
+ * node plugin/print-pdf/parallel.js "index.html?print-pdf" slides.pdf 1024x768 4
+ */
+
+var spawn = require( 'child_process' ).spawn;
+var fs = require( 'fs' );
+var os = require( 'os' );
+var path = require( 'path' );
+
+var args = process.argv.slice( 2 );
+
+var inputFile = args[0] || 'index.html?print-pdf';
+var outputFile = args[1] || inputFile.replace( /\?.*$/, '' ).replace( /\.html$/, '.pdf' );
+var slideSize = args[2] || '';
+var workers = Math.max( parseInt( args[3], 10 ) || os.cpus().length, 1 );
+
+var script = path.join( __dirname, 'print-pdf.js' );
+
+function run( command, commandArgs, callback ) {
+
+	var child = spawn( command, commandArgs, { stdio: 'inherit' } );
+
+	child.on( 'error', function( error ) {
+		callback( error );
+	} );
+
+	child.on( 'exit', function( code ) {
+		callback( code === 0 ? null : new Error( command + ' exited with code ' + code ) );
+	} );
+
+}
+
+function printParts( callback ) {
+
+	var parts = [],
+		pending = workers,
+		failed = null;
+
+	for( var i = 0; i < workers; i++ ) {
+		var partFile = path.join( os.tmpdir(), 'reveal-pdf-' + process.pid + '-' + i + '.pdf' ),
+			partUrl = inputFile + ( inputFile.indexOf( '?' ) === -1 ? '?' : '&' ) + 'pdfPart=' + i + '&pdfParts=' + workers;
+
+		parts.push( partFile );
+
+		run( 'phantomjs', [ script, partUrl, partFile, slideSize ], function( error ) {
+			failed = failed || error;
+
+			if( --pending === 0 ) {
+				callback( failed, parts );
+			}
+		} );
+	}
+
+}
+
+function mergeParts( parts, callback ) {
+
+	run( 'gs', [ '-q', '-dBATCH', '-dNOPAUSE', '-dDetectDuplicateImages=true', '-sDEVICE=pdfwrite', '-sOutputFile=' + outputFile ].concat( parts ), function( error ) {
+		if( error && error.code === 'ENOENT' ) {
+			run( 'pdfunite', parts.concat( outputFile ), callback );
+		}
+		else {
+			callback( error );
+		}
+	} );
+
+}
+
+function removeParts( parts ) {
+
+	parts.forEach( function( part ) {
+		try {
+			fs.unlinkSync( part );
+		}
+		catch( error ) {}
+	} );
+
+}
+
+console.log( 'Printing ' + inputFile + ' to ' + outputFile + ' with ' + workers + ' workers' );
+
+printParts( function( error, parts ) {
+
+	if( error ) {
+		console.error( 'Printing failed: ' + error.message );
+		removeParts( parts );
+		process.exit( 1 );
+	}
+
+	// Parts without slides are not printed
+	parts = parts.filter( function( part ) {
+		return fs.existsSync( part );
+	} );
+
+	mergeParts( parts, function( error ) {
+		removeParts( parts );
+
+		if( error ) {
+			console.error( 'Merging failed, Ghostscript or pdfunite is required: ' + error.message );
+			process.exit( 1 );
+		}
+
+		console.log( 'Export complete' );
+	} );
+
+} );
@@ -40,8 +40,20 @@ console.log( 'Printing PDF (Paper size: '+ page.paperSize.width + 'x' + page.pap
 
 page.open( inputFile, function( status ) {
 	window.setTimeout( function() {
-		console.log( 'Printed succesfully' );
-		page.render( outputFile );
+		// A part of the presentation (see the pdfParts config option)
+		// may hold no slides, don't print a blank page for it
+		var slides = page.evaluate( function() {
+			return document.querySelectorAll( '.reveal .slides > section' ).length;
+		} );
+
+		if( slides === 0 ) {
+			console.log( 'No slides to print' );
+		}
+		else {
+			console.log( 'Printed succesfully' );
+			page.render( outputFile );
+		}
+
 		phantom.exit();
 	}, 1000 );
 } );
@@ -0,0 +1,114 @@
+/**
+ * Builds the inverted index loaded by the search plugin. Maps every
+ * term found in the slides of a presentation to the (h, v) positions
+ * of the slides containing it, so that queries don't need to walk the
+ * DOM.
+ *
+ * Run through the `searchindex` Grunt task.
+ */
+(function( root, factory ) {
+	if( typeof exports === 'object' ) {
+		module.exports = factory();
+	}
+	else {
+		// Browser globals (root is window)
+		root.RevealSearchIndexer = factory();
+	}
+}( this, function() {
+
+	var ENTITIES = {
+		amp: '&',
+		lt: '<',
+		gt: '>',
+		quot: '"',
+		apos: '\'',
+		nbsp: ' '
+	};
+
+	// Same word characters the search plugin splits queries on
+	var TERM_SEPARATOR = /[^\w'-]+/;
+
+	function decodeEntities( text ) {
+
+		return text.replace( /&(#?\w+);/g, function( entity, name ) {
+			if( name.charAt( 0 ) === '#' ) {
+				var code = name.charAt( 1 ).toLowerCase() === 'x' ? parseInt( name.slice( 2 ), 16 ) : parseInt( name.slice( 1 ), 10 );
+				return isNaN( code ) ? ' ' : String.fromCharCode( code );
+			}
+
+			return ENTITIES.hasOwnProperty( name ) ? ENTITIES[ name ] : ' ';
+		} );
+
+	}
+
+	/**
+	 * @param {String} html Source of the presentation
+	 * @return {Object} { total, slides: [ [h, v], ... ], terms: { term: [ slide, ... ] } }
+	 */
+	return function( html ) {
+
+		if( /<section\b[^>]*\bdata-markdown\b/i.test( html ) ) {
+			throw new Error( 'Markdown slides are only split at runtime, their positions can not be indexed' );
+		}
+
+		// Text of scripts, styles and comments is never displayed
+		html = html.replace( /<!--[\s\S]*?-->|<(script|style)\b[^>]*>[\s\S]*?<\/\1>/gi, ' ' );
+
+		var index = { total: 0, slides: [], terms: {} },
+			tag = /<(\/?)section\b[^>]*>/gi,
+			stack = [],
+			h = -1,
+			v = 0,
+			start = 0,
+			match;
+
+		function addText( text ) {
+
+			var terms = decodeEntities( text.replace( /<[^>]*>/g, ' ' ) ).toLowerCase().split( TERM_SEPARATOR ).filter( Boolean );
+
+			if( !stack.length || !terms.length ) return;
+
+			// Text of a vertical stack outside its child sections belongs to
+			// the first slide of the stack, like Reveal.getIndices() reports
+			var position = stack.length > 1 ? v : 0,
+				slides = stack[ stack.length - 1 ].slides,
+				slide = slides[ position ];
+
+			if( slide === undefined ) {
+				slide = slides[ position ] = index.slides.push( [ h, position ] ) - 1;
+			}
+
+			terms.forEach( function( term ) {
+				var list = index.terms.hasOwnProperty( term ) ? index.terms[ term ] : ( index.terms[ term ] = [] );
+				if( list[ list.length - 1 ] !== slide ) list.push( slide );
+			} );
+
+		}
+
+		while( ( match = tag.exec( html ) ) ) {
+			addText( html.slice( start, match.index ) );
+			start = tag.lastIndex;
+
+			if( match[1] ) {
+				var closed = stack.pop();
+				if( closed && !closed.children ) index.total++;
+				if( stack.length === 1 ) v++;
+			}
+			else {
+				if( stack.length ) {
+					stack[ stack.length - 1 ].children = true;
+				}
+				else {
+					h++;
+					v = 0;
+				}
+
+				stack.push( { slides: stack.length ? stack[0].slides : [], children: false } );
+			}
+		}
+
+		return index;
+
+	};
+
+}));
@@ -11,6 +11,7 @@ var RevealSearch = (function() {
 	var currentMatchedIndex;
 	var searchboxDirty;
 	var myHilitor;
+	var searchIndex;
 
 // Original JavaScript code by Chirp Internet: www.chirp.com.au
 // Please acknowledge use of this code by including this header.
@@ -27,6 +28,7 @@ function Hilitor(id, tag)
   var colorIdx = 0;
   var matchRegex = "";
   var matchingSlides = [];
+  var fragmentSection = null;
 
   this.setRegex = function(input)
   {
@@ -54,9 +56,11 @@ function Hilitor(id, tag)
       if((nv = node.nodeValue) && (regs = matchRegex.exec(nv))) {
       	//find the slide's section element and save it in our list of matching slides
       	var secnode = node.parentNode;
-      	while (secnode.nodeName != 'SECTION') {
+      	while (secnode && secnode.nodeName != 'SECTION') {
       		secnode = secnode.parentNode;
       	}
+      	//content detached by the virtualize option belongs to the section it was detached from
+      	secnode = secnode || fragmentSection;
       	
       	var slideIndex = Reveal.getIndices(secnode);
       	var slidelen = matchingSlides.length;
@@ -87,6 +91,18 @@ function Hilitor(id, tag)
     }
   };
 
+  // apply word highlighting to the content the virtualize option detached from the given sections
+  this.hiliteDetached = function(sections)
+  {
+    for(var i=0; i < sections.length; i++) {
+      if(sections[i].virtualContent) {
+        fragmentSection = sections[i];
+        this.hiliteWords(sections[i].virtualContent);
+      }
+    }
+    fragmentSection = null;
+  };
+
   // remove highlighting
   this.remove = function()
   {
@@ -94,6 +110,15 @@ function Hilitor(id, tag)
     while(arr.length && (el = arr[0])) {
       el.parentNode.replaceChild(el.firstChild, el);
     }
+
+    var sections = targetNode.querySelectorAll("section");
+    for(var i=0; i < sections.length; i++) {
+      if(sections[i].virtualContent) {
+        var detached = sections[i].virtualContent.querySelectorAll(hiliteTag);
+        for(var j=0; j < detached.length; j++)
+          detached[j].parentNode.replaceChild(detached[j].firstChild, detached[j]);
+      }
+    }
   };
 
   // start highlighting at target node
@@ -103,7 +128,21 @@ function Hilitor(id, tag)
     this.remove();
     this.setRegex(input);
     this.hiliteWords(targetNode);
-    return matchingSlides;
+    this.hiliteDetached(targetNode.querySelectorAll("section"));
+    //detached content is walked last, restore the presentation order
+    return matchingSlides.sort(function(a, b) { return a.h - b.h || a.v - b.v; });
+  };
+
+  // highlight only the given nodes, when the matching slides are already known
+  this.applyTo = function(input, nodes)
+  {
+    if(input == undefined || !input) return;
+    this.remove();
+    this.setRegex(input);
+    for(var i=0; i < nodes.length; i++) {
+      this.hiliteWords(nodes[i]);
+      this.hiliteDetached([nodes[i]]);
+    }
   };
 
 }
@@ -127,14 +166,66 @@ function Hilitor(id, tag)
 		}
 	}
 
+	//load the index built by the 'searchindex' grunt task, if configured
+	function loadIndex(url) {
+		var xhr = new XMLHttpRequest();
+
+		xhr.onreadystatechange = function() {
+			if (xhr.readyState === 4 && (xhr.status === 200 || xhr.status === 0) && xhr.responseText) {
+				try {
+					searchIndex = JSON.parse(xhr.responseText);
+				}
+				catch (e) {
+					console.warn('Could not parse the search index ' + url);
+				}
+			}
+		};
+
+		xhr.open('GET', url, true);
+		xhr.send();
+	}
+
+	//look the keywords up in the prebuilt index, returns the matching slide positions in presentation order
+	function searchInIndex(searchstring) {
+		var words = searchstring.toLowerCase().replace(/^[^\w]+|[^\w]+$/g, "").split(/[^\w'-]+/);
+		var found = {};
+		var slides = [];
+
+		//same as the Hilitor regex, a keyword matches anywhere inside a term
+		for (var term in searchIndex.terms) {
+			for (var i = 0; i < words.length; i++) {
+				if (words[i] && term.indexOf(words[i]) !== -1) {
+					searchIndex.terms[term].forEach(function(slide) { found[slide] = true; });
+					break;
+				}
+			}
+		}
+
+		for (var slide in found) {
+			slides.push({ h: searchIndex.slides[slide][0], v: searchIndex.slides[slide][1] });
+		}
+
+		return slides.sort(function(a, b) { return a.h - b.h || a.v - b.v; });
+	}
+
 	function doSearch() {
 		//if there's been a change in the search term, perform a new search:
 		if (searchboxDirty) {
 			var searchstring = document.getElementById("searchinput").value;
 
-			//find the keyword amongst the slides
 			myHilitor = new Hilitor("slidecontent");
-			matchedSlides = myHilitor.apply(searchstring);
+
+			//an index built before slides were added or removed is stale, fall back to walking the slides
+			if (searchIndex && searchIndex.total === Reveal.getTotalSlides()) {
+				matchedSlides = searchInIndex(searchstring);
+				myHilitor.applyTo(searchstring, matchedSlides.map(function(slide) {
+					return Reveal.getSlide(slide.h, slide.v);
+				}));
+			}
+			else {
+				//find the keyword amongst the slides
+				matchedSlides = myHilitor.apply(searchstring);
+			}
 			currentMatchedIndex = 0;
 		}
 
@@ -151,6 +242,10 @@ function Hilitor(id, tag)
 	var dom = {};
 	dom.wrapper = document.querySelector( '.reveal' );
 
+	if( Reveal.getConfig().searchIndex ) {
+		loadIndex( Reveal.getConfig().searchIndex );
+	}
+
 	if( !dom.wrapper.querySelector( '.searchbox' ) ) {
 			var searchElement = document.createElement( 'div' );
 			searchElement.id = "searchinputdiv";
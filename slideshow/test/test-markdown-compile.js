@@ -0,0 +1,85 @@
+
+
+Reveal.addEventListener( 'ready', function() {
+
+	QUnit.module( 'Markdown Compile' );
+
+	var source = [
+		'<section data-markdown data-separator="^\\n---\\n$" data-separator-vertical="^\\n--\\n$" data-separator-notes="^Note:">',
+			'<script type="text/template">',
+				'## Slide 1.1',
+				'<!-- .element: class="fragment fade-out" data-fragment-index="1" -->',
+				'',
+				'--',
+				'',
+				'## Slide 1.2',
+				'<!-- .slide: data-background="#ff0000" -->',
+				'',
+				'- list item 1 <!-- .element: class="fragment grow" -->',
+				'- list item 2 <!-- .element: class="fragment grow" -->',
+				'',
+				'---',
+				'',
+				'## Slide 2',
+				'',
+				'Note:',
+				'Some **notes**',
+			'</script>',
+		'</section>',
+		'<section data-markdown data-transition="zoom">',
+			'<script type="text/template">',
+				'## Single slide',
+			'</script>',
+		'</section>',
+		'<section data-markdown="external.md" data-separator="^\\n\\n\\n"></section>',
+		'<!-- <section data-markdown="commented.md"></section> -->'
+	].join( '\n' );
+
+	function compile( html, options ) {
+		var container = document.createElement( 'div' );
+		container.innerHTML = RevealMarkdown.compile( html, options );
+		return container;
+	}
+
+	function readFile( url ) {
+		if( url === 'external.md' ) return '# External 1\n\n\n\n# External 2';
+		throw new Error( 'Not found' );
+	}
+
+	test( 'Separators', function() {
+		var slides = compile( source, { readFile: readFile } );
+
+		strictEqual( slides.querySelectorAll( 'div>section' ).length, 5, 'found five horizontal slides' );
+		strictEqual( slides.querySelectorAll( 'div>section>section' ).length, 2, 'found two vertical slides' );
+		strictEqual( slides.querySelectorAll( '[data-markdown]' ).length, 0, 'no markdown left for the runtime plugin' );
+	});
+
+	test( 'Attributes', function() {
+		var slides = compile( source, { readFile: readFile } );
+
+		strictEqual( slides.querySelectorAll( 'h2.fragment.fade-out[data-fragment-index="1"]' ).length, 1, 'found element attributes on the header' );
+		strictEqual( slides.querySelectorAll( 'li.fragment.grow' ).length, 2, 'found element attributes on both list items' );
+		strictEqual( slides.querySelectorAll( 'section[data-background="#ff0000"]' ).length, 1, 'found slide attributes on the section' );
+		strictEqual( slides.querySelectorAll( 'section[data-transition="zoom"]' ).length, 1, 'kept the attributes of a single slide' );
+	});
+
+	test( 'Notes', function() {
+		var notes = compile( source, { readFile: readFile } ).querySelectorAll( 'aside.notes' );
+
+		strictEqual( notes.length, 1, 'found one notes element' );
+		strictEqual( notes[0].querySelectorAll( 'strong' ).length, 1, 'notes are converted to HTML' );
+		strictEqual( notes[0].hasAttribute( 'data-markdown' ), false, 'notes no longer need converting' );
+	});
+
+	test( 'External markdown', function() {
+		var warnings = [],
+			slides = compile( source.replace( 'external.md', 'missing.md' ), { readFile: readFile, warn: function( message ) { warnings.push( message ); } } );
+
+		strictEqual( compile( source, { readFile: readFile } ).querySelectorAll( 'h1' ).length, 2, 'external file split into two slides' );
+		strictEqual( slides.querySelectorAll( 'section[data-markdown="missing.md"]' ).length, 1, 'unreadable file left for the runtime plugin' );
+		strictEqual( warnings.length, 1, 'unreadable file reported' );
+	});
+
+} );
+
+Reveal.initialize();
@@ -0,0 +1,33 @@
+
+
+Reveal.addEventListener( 'ready', function() {
+
+	QUnit.module( 'Search Index' );
+
+	var source = [
+		'<section><h2>Alpha</h2></section>',
+		'<!-- <section><h2>Hidden</h2></section> -->',
+		'<section>',
+			'<section><h2>Bravo</h2> <!-- .element: class="fragment" --></section>',
+			'<section><h2>Charlie</h2></section>',
+		'</section>'
+	].join( '\n' );
+
+	test( 'Slides', function() {
+		var index = RevealSearchIndexer( source );
+
+		strictEqual( index.total, 3, 'commented out slide is not counted' );
+		deepEqual( index.slides, [ [ 0, 0 ], [ 1, 0 ], [ 1, 1 ] ], 'slide positions are not shifted' );
+	});
+
+	test( 'Terms', function() {
+		var index = RevealSearchIndexer( source );
+
+		deepEqual( index.terms[ 'charlie' ], [ 2 ], 'found the term of a vertical slide' );
+		strictEqual( index.terms.hasOwnProperty( 'hidden' ), false, 'text of comments is not indexed' );
+		strictEqual( index.terms.hasOwnProperty( 'fragment' ), false, 'element attribute comments are not indexed' );
+	});
+
+} );
+
+Reveal.initialize();
@@ -0,0 +1,72 @@
+
+// Slide contents are only detached once the page has loaded, hold
+// QUnit back until the tests below are registered
+QUnit.config.autostart = false;
+
+window.addEventListener( 'load', function() {
+
+	setTimeout( function() {
+
+		QUnit.module( 'Virtualize' );
+
+		test( 'Detached slides', function() {
+			Reveal.slide( 0 );
+
+			strictEqual( Reveal.getSlide( 0 ).querySelectorAll( 'h1' ).length, 1, 'current slide has its contents' );
+			strictEqual( Reveal.getSlide( 4 ).childNodes.length, 0, 'slide outside of the view distance is empty' );
+			strictEqual( Reveal.getSlide( 5, 0 ).childNodes.length, 0, 'vertical slide outside of the view distance is empty' );
+			strictEqual( Reveal.getSlide( 5 ).querySelectorAll( 'section' ).length, 2, 'stack keeps its vertical slides' );
+			strictEqual( Reveal.getTotalSlides(), 9, 'all slides are counted' );
+		});
+
+		test( 'Navigation restores contents', function() {
+			Reveal.slide( 4 );
+
+			strictEqual( Reveal.getSlide( 4 ).querySelectorAll( 'h1' ).length, 1, 'current slide has its contents back' );
+			strictEqual( Reveal.getSlide( 0 ).childNodes.length, 0, 'previous slide is now empty' );
+
+			Reveal.slide( 0 );
+		});
+
+		test( 'Backgrounds of detached slides', function() {
+			Reveal.slide( 1 );
+			Reveal.slide( 4 );
+
+			notStrictEqual( Reveal.getSlideBackground( 1 ).style.backgroundImage, '', 'data-background that isn\'t an image is kept' );
+
+			Reveal.slide( 0 );
+		});
+
+		test( 'Fragments of detached slides', function() {
+			Reveal.slide( 7 );
+			Reveal.slide( 3 );
+
+			strictEqual( Reveal.getSlide( 3 ).querySelectorAll( '.fragment.visible' ).length, 2, 'fragments became visible while the slide was detached' );
+
+			Reveal.slide( 0 );
+			Reveal.slide( 3 );
+
+			strictEqual( Reveal.getSlide( 3 ).querySelectorAll( '.fragment.visible' ).length, 0, 'fragments were hidden while the slide was detached' );
+
+			Reveal.slide( 0 );
+		});
+
+		test( 'Reveal.getSlideNotes', function() {
+			strictEqual( Reveal.getSlideNotes( Reveal.getSlide( 3 ) ), 'Notes 4', 'reads notes of a detached slide' );
+		});
+
+		test( 'Reveal.configure', function() {
+			Reveal.configure({ virtualize: false });
+
+			strictEqual( Reveal.getSlide( 6 ).querySelectorAll( 'h1' ).length, 1, 'contents restored when turned off' );
+
+			Reveal.configure({ virtualize: true });
+		});
+
+		QUnit.start();
+
+	}, 10 );
+
+}, false );
+
+Reveal.initialize({ virtualize: true, viewDistance: 2 });